@@ -1,4 +1,5 @@
 #include "pieceRenderer.h"
+#include "positionFeed.h"
 #include <SDL3/SDL_render.h>
 #include <SDL3/SDL_surface.h>
 #define SDL_MAIN_USE_CALLBACKS
@@ -12,6 +13,8 @@
 #include <SDL3/SDL_main.h>
 
 Board board;
+PositionFeed* feed;
+bool feedOpen = false;
 SDL_Window* window;
 SDL_GPUDevice* device;
 SDL_GPUBuffer* vBuffer;
@@ -22,6 +25,23 @@ SDL_GPUGraphicsPipeline* gPipeline;
 
 Uint32 vertexCount = 0;
 
+// producer write -> GPU finished the frame, for fed positions.
+// present itself isn't observable through SDL_gpu, so this is the closest point.
+// dropped counts pushed positions that were overwritten before a frame showed them
+Uint64 feedFrames = 0;
+Uint64 feedDropped = 0;
+Uint64 feedLatencyTotal = 0;
+Uint64 feedLatencyMax = 0;
+
+static void logFeedLatency() {
+  if(feedFrames == 0) return;
+  SDL_Log("Feed write->GPU done over %llu frames: avg %.3f ms, max %.3f ms, %llu positions dropped",
+    (unsigned long long)feedFrames,
+    feedLatencyTotal / (double)feedFrames / 1e6,
+    feedLatencyMax / 1e6,
+    (unsigned long long)feedDropped);
+}
+
 struct vertex {
   float x, y, z;
   float r, g, b, a;
@@ -97,6 +117,13 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
 
   pieceRenderer = new PieceRenderer(device, window);
 
+  const char* feedName = SDL_getenv("CHESSTER_FEED");
+  feed = new PositionFeed(feedName ? feedName : FEED_SHM_NAME);
+  feedOpen = feed->create();
+  if(!feedOpen) {
+    SDL_Log("Warning: Could not open position feed (in use by another renderer?), showing local board only");
+  }
+
 
   //bufferInfo below
   SDL_GPUBufferCreateInfo bufferInfo{};
@@ -248,6 +275,10 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
 SDL_AppResult SDL_AppIterate(void *appstate) {
   (void)appstate;
 
+  Uint64 feedWriteNs = 0;
+  Uint64 feedSkipped = 0;
+  bool fed = feedOpen && feed->poll(board, feedWriteNs, feedSkipped);
+
   SDL_GPUCommandBuffer* uploadCmd = SDL_AcquireGPUCommandBuffer(device);
   pieceRenderer->updateVertices(uploadCmd, board);
   SDL_SubmitGPUCommandBuffer(uploadCmd);
@@ -258,6 +289,7 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
 
   if(!SDL_WaitAndAcquireGPUSwapchainTexture(cmd, window, &sTexture, &width, &height)) {
     SDL_SubmitGPUCommandBuffer(cmd);
+    if(fed) feedDropped += feedSkipped + 1;
     return SDL_APP_CONTINUE;
   }
 
@@ -284,7 +316,22 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
   );
   pieceRenderer->draw(rPass);
   SDL_EndGPURenderPass(rPass);
-  SDL_SubmitGPUCommandBuffer(cmd);
+
+  if(!fed) {
+    SDL_SubmitGPUCommandBuffer(cmd);
+  } else {
+    SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(cmd);
+    if(fence) {
+      SDL_WaitForGPUFences(device, true, &fence, 1);
+      SDL_ReleaseGPUFence(device, fence);
+    }
+    Uint64 latency = feedNowNs() - feedWriteNs;
+    feedFrames++;
+    feedDropped += feedSkipped;
+    feedLatencyTotal += latency;
+    if(latency > feedLatencyMax) feedLatencyMax = latency;
+    if(feedFrames % 600 == 0) logFeedLatency();
+  }
 
   return SDL_APP_CONTINUE;
 }
@@ -305,6 +352,8 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result) {
   (void)result;
 
   delete pieceRenderer;
+  logFeedLatency();
+  delete feed;
 
   SDL_ReleaseGPUBuffer(device, vBuffer);
   SDL_ReleaseGPUTransferBuffer(device, transferBuffer);
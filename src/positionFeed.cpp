@@ -0,0 +1,165 @@
+#include "positionFeed.h"
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// a slot still mid-write after this long belongs to a dead producer and may be reclaimed
+constexpr uint64_t FEED_STALE_NS = 50000000;
+
+uint64_t feedNowNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+PositionFeed::PositionFeed(const char* name)
+  : name(name), fd(-1), header(nullptr), owner(false), nextTicket(0) {}
+
+PositionFeed::~PositionFeed() {
+  if(header) munmap(header, sizeof(FeedHeader));
+  // unlink while the flock is still held so we never remove another renderer's segment
+  if(owner) shm_unlink(name.c_str());
+  if(fd >= 0) close(fd);
+}
+
+bool PositionFeed::map() {
+  void* mem = mmap(nullptr, sizeof(FeedHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if(mem == MAP_FAILED) return false;
+  header = (FeedHeader*)mem;
+  return true;
+}
+
+bool PositionFeed::create() {
+  fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+  if(fd < 0) return false;
+
+  // a live renderer holds the lock; a segment whose owner died can be taken over
+  if(flock(fd, LOCK_EX | LOCK_NB) != 0) {
+    close(fd);
+    fd = -1;
+    return false;
+  }
+  owner = true;
+
+  if(ftruncate(fd, sizeof(FeedHeader)) != 0) return false;
+  void* mem = mmap(nullptr, sizeof(FeedHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if(mem == MAP_FAILED) return false;
+
+  header = new (mem) FeedHeader();
+  header->slotCount = FEED_SLOTS;
+  header->magic.store(FEED_MAGIC, std::memory_order_release);
+  return true;
+}
+
+bool PositionFeed::attach() {
+  fd = shm_open(name.c_str(), O_RDWR, 0);
+  if(fd < 0) return false;
+
+  // getting a shared lock means no renderer holds the exclusive one
+  if(flock(fd, LOCK_SH | LOCK_NB) == 0) {
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t)st.st_size != sizeof(FeedHeader) || !map()) {
+    close(fd);
+    fd = -1;
+    return false;
+  }
+  if(header->magic.load(std::memory_order_acquire) != FEED_MAGIC || header->slotCount != FEED_SLOTS) {
+    munmap(header, sizeof(FeedHeader));
+    header = nullptr;
+    close(fd);
+    fd = -1;
+    return false;
+  }
+  return true;
+}
+
+void PositionFeed::push(const char layout[8][8]) {
+  uint64_t words[8];
+  std::memcpy(words, layout, sizeof(words));
+
+  uint64_t ticket = header->head.fetch_add(1, std::memory_order_relaxed);
+  FeedSlot& slot = header->slots[ticket % FEED_SLOTS];
+
+  // claim the slot: even -> odd. a slot that stays at the same odd seq for
+  // FEED_STALE_NS was left by a producer that died mid-write; take it over
+  // straight to the next odd value so its half-written state is never published
+  uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+  uint32_t waitingOn = 0;
+  uint64_t waitStart = 0;
+  for(;;) {
+    if(seq & 1) {
+      uint64_t now = feedNowNs();
+      if(seq != waitingOn) {
+        waitingOn = seq;
+        waitStart = now;
+      } else if(now - waitStart > FEED_STALE_NS) {
+        if(slot.seq.compare_exchange_strong(seq, seq + 2, std::memory_order_relaxed)) {
+          seq++;
+          break;
+        }
+        continue;
+      }
+      sched_yield();
+      seq = slot.seq.load(std::memory_order_relaxed);
+      continue;
+    }
+    if(slot.seq.compare_exchange_weak(seq, seq + 1, std::memory_order_relaxed)) break;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.ticket.store(ticket + 1, std::memory_order_relaxed);
+  for(int i = 0; i < 8; i++) {
+    slot.layout[i].store(words[i], std::memory_order_relaxed);
+  }
+  slot.writeNs.store(feedNowNs(), std::memory_order_relaxed);
+
+  // publish only if nobody reclaimed the slot from under us
+  uint32_t claimed = seq + 1;
+  slot.seq.compare_exchange_strong(claimed, seq + 2, std::memory_order_release);
+}
+
+bool PositionFeed::poll(Board& board, uint64_t& writeNs, uint64_t& skipped) {
+  if(!header) return false;
+
+  uint64_t head = header->head.load(std::memory_order_acquire);
+
+  // newest completed slot wins; older unread states are dropped, only the latest is shown
+  for(uint64_t want = head; want > nextTicket && head - want < FEED_SLOTS; want--) {
+    const FeedSlot& slot = header->slots[(want - 1) % FEED_SLOTS];
+    uint32_t before = slot.seq.load(std::memory_order_acquire);
+    if(before == 0 || (before & 1)) continue;
+
+    uint64_t ticket = slot.ticket.load(std::memory_order_relaxed);
+    uint64_t stamp = slot.writeNs.load(std::memory_order_relaxed);
+    uint64_t words[8];
+    for(int i = 0; i < 8; i++) {
+      words[i] = slot.layout[i].load(std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if(slot.seq.load(std::memory_order_relaxed) != before) continue;
+    if(ticket != want) continue;
+
+    char layout[64];
+    std::memcpy(layout, words, sizeof(layout));
+    for(int i = 0; i < 64; i++) {
+      if(board.get(i / 8, i % 8) != layout[i]) board.set(i / 8, i % 8, layout[i]);
+    }
+    skipped = want - 1 - nextTicket;
+    nextTicket = want;
+    writeNs = stamp;
+    return true;
+  }
+  return false;
+}
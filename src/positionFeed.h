@@ -0,0 +1,61 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "board.h"
+
+// shared-memory ring of board states written by external producers.
+// every slot is guarded by its own seqlock: odd seq = write in progress.
+constexpr const char* FEED_SHM_NAME = "/chesster_feed";
+constexpr uint32_t    FEED_MAGIC    = 0x43484653u;
+constexpr uint32_t    FEED_SLOTS    = 64;
+
+// all fields are atomics so the seqlock's racy reads stay well-defined;
+// the layout travels as 8 relaxed 64-bit words
+struct alignas(64) FeedSlot {
+  std::atomic<uint32_t> seq;
+  uint32_t reserved;
+  std::atomic<uint64_t> ticket;    // ticket + 1, so a zeroed slot never looks written
+  std::atomic<uint64_t> writeNs;
+  std::atomic<uint64_t> layout[8];
+};
+
+struct FeedHeader {
+  std::atomic<uint32_t> magic;
+  uint32_t slotCount;
+  std::atomic<uint64_t> head;
+  FeedSlot slots[FEED_SLOTS];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "feed needs lock-free atomics");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "feed needs lock-free atomics");
+
+// CLOCK_MONOTONIC, shared by producers and the renderer for latency numbers
+uint64_t feedNowNs();
+
+class PositionFeed {
+  public:
+    explicit PositionFeed(const char* name = FEED_SHM_NAME);
+    ~PositionFeed();
+
+    // renderer side owns the segment and holds an exclusive flock on it for
+    // its lifetime; create() fails while another live renderer owns the name.
+    // producers attach only while an owner is alive
+    bool create();
+    bool attach();
+
+    void push(const char layout[8][8]);
+
+    // applies the newest finished state; skipped counts the tickets since the
+    // last poll that were never shown (overwritten, or abandoned mid-write)
+    bool poll(Board& board, uint64_t& writeNs, uint64_t& skipped);
+
+  private:
+    bool map();
+
+    std::string name;
+    int fd;
+    FeedHeader* header;
+    bool owner;
+    uint64_t nextTicket;
+};
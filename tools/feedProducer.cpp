@@ -0,0 +1,48 @@
+// pushes positions into the renderer's shared-memory feed.
+// build: make bin/feedProducer
+// usage: feedProducer [rateHz] [count] [shmName]
+#include "../src/positionFeed.h"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+int main(int argc, char** argv) {
+  int rate  = argc > 1 ? atoi(argv[1]) : 60;
+  int count = argc > 2 ? atoi(argv[2]) : 600;
+  if(rate <= 0) rate = 60;
+
+  PositionFeed feed(argc > 3 ? argv[3] : FEED_SHM_NAME);
+  if(!feed.attach()) {
+    fprintf(stderr, "feed not found, start the renderer first\n");
+    return 1;
+  }
+
+  Board board;
+  char layout[8][8];
+  for(int row = 0; row < 8; row++) {
+    for(int col = 0; col < 8; col++) {
+      layout[row][col] = board.get(row, col);
+    }
+  }
+
+  // hop the white king's knight b1 <-> c3 so every push is a new position
+  uint64_t periodNs = 1000000000ULL / rate;
+  uint64_t next = feedNowNs();
+  for(int i = 0; i < count; i++) {
+    bool out = (i % 2) == 0;
+    layout[7][1] = out ? 0 : 'N';
+    layout[5][2] = out ? 'N' : 0;
+    feed.push(layout);
+
+    next += periodNs;
+    uint64_t now = feedNowNs();
+    if(next > now) {
+      timespec ts;
+      ts.tv_sec  = (time_t)((next - now) / 1000000000ULL);
+      ts.tv_nsec = (long)((next - now) % 1000000000ULL);
+      nanosleep(&ts, nullptr);
+    }
+  }
+  printf("pushed %d positions at %d Hz\n", count, rate);
+  return 0;
+}